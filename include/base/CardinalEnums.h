@@ -28,6 +28,7 @@ MooseEnum getTallyTypeEnum();
 MooseEnum getEigenvalueEnum();
 MooseEnum getChannelTypeEnum();
 MooseEnum getRelaxationEnum();
+MooseEnum getParticleControlEnum();
 
 namespace order
 {
@@ -85,6 +86,34 @@ namespace operation
   };
 }
 
+namespace reduction
+{
+  /// Enumeration of reductions of the nekRS solution that can be evaluated together
+  enum NekReductionEnum
+  {
+    side_integral,
+    side_mass_flux_integral,
+    side_max,
+    side_min,
+    volume_integral,
+    volume_max,
+    volume_min
+  };
+}
+
+namespace transfer
+{
+  /// Enumeration of the phases of a transfer of the nekRS solution onto the mesh mirror
+  enum NekTransferPhaseEnum
+  {
+    gather,
+    interpolate,
+    communicate,
+    scatter,
+    n_phases
+  };
+}
+
 namespace tally
 {
   /// Type of tally to construct for the OpenMC model
@@ -140,3 +169,14 @@ namespace relaxation
     none
   };
 }
+
+namespace particle_control
+{
+  /// Tally relative error used to choose the number of particles
+  enum ParticleControlEnum
+  {
+    max_relative_error,
+    mean_relative_error,
+    none
+  };
+}
@@ -27,6 +27,8 @@
 #include "meshSetup.hpp"
 #include "libmesh/point.h"
 #include "mesh.h"
+#include <functional>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -69,6 +71,19 @@ void buildOnly(int buildOnly);
  */
 int buildOnly();
 
+/**
+ * Set whether the nekRS solution is communicated in single precision when gathering
+ * it onto the mesh mirror
+ * @param[in] single whether to communicate in single precision
+ */
+void singlePrecisionTransfers(const bool single);
+
+/**
+ * Whether the nekRS solution is communicated in single precision when gathering it onto the mesh mirror
+ * @return whether transfers are communicated in single precision
+ */
+bool singlePrecisionTransfers();
+
 /**
  * Whether nekRS's input file has CHT
  * @return whether nekRS input files model CHT
@@ -201,6 +216,19 @@ void copyScratchToDevice();
 /// Copy volume deformation of mesh from host to device for moving-mesh problems
 void copyDeformationToDevice();
 
+/**
+ * Copy the mesh coordinates and geometric factors from device to host for moving-mesh
+ * problems, where nekRS may have moved the mesh on the device during the time step
+ */
+void copyDeformationToHost();
+
+/**
+ * Get a counter of the number of times that the mesh has been deformed, which can be used
+ * to determine whether quantities computed from the mesh geometry are out of date
+ * @return mesh version
+ */
+int meshVersion();
+
 /**
  * Determine the receiving counts and displacements for all gather routines
  * @param[in] base_counts unit-wise receiving counts for each process
@@ -251,14 +279,96 @@ Point centroid(int local_elem_id);
  */
 Point gllPoint(int local_elem_id, int local_node_id);
 
+/// Persistent gather of a transfer plan's send buffer, with the buffers it was set up for
+struct persistentGather
+{
+  /// Persistent request, or MPI_REQUEST_NULL if not yet set up
+  MPI_Request request = MPI_REQUEST_NULL;
+
+  /// Buffers with which the request was set up
+  void * send = nullptr;
+  void * receive = nullptr;
+};
+
+/**
+ * \brief Communication plan for gathering data on the coupled nekRS elements onto all ranks
+ *
+ * Each rank contributes a fixed number of values for each coupled element (or face) that it
+ * owns. The counts and displacements of each rank's contribution and the buffers used to build
+ * this rank's contribution are set up once for each coupling and number of values per element,
+ * so that repeated transfers don't allocate any memory. When the MPI library supports
+ * persistent collectives, the gather in each precision is also only set up once.
+ */
+struct transferPlan
+{
+  /// Number of values contributed by each rank
+  std::vector<int> counts;
+
+  /// Offset of each rank's contribution in the gathered array
+  std::vector<int> displacement;
+
+  /// This rank's contribution
+  std::vector<double> send;
+
+  /**
+   * Gathered values in double precision, before they are copied into the output array; the
+   * persistent gather needs fixed buffers, while the output array differs between fields
+   * (only used with persistent collectives)
+   */
+  std::vector<double> receive;
+
+  /// This rank's contribution, rounded to single precision (sized on the first single precision transfer)
+  std::vector<float> send_single;
+
+  /// Gathered values in single precision, before they are widened into the output array
+  std::vector<float> receive_single;
+
+  /// Maximum absolute error introduced by rounding values to single precision
+  double max_rounding_error = 0.0;
+
+  /// Staging space for the rank-local nekRS solution before interpolation (boundary transfers only)
+  std::vector<double> gathered;
+
+  /// Persistent gather of the send buffer in double precision
+  persistentGather gather_double;
+
+  /// Persistent gather of the send buffer in single precision
+  persistentGather gather_single;
+
+  /// Accumulated time (seconds) spent in each transfer::NekTransferPhaseEnum
+  double time[transfer::n_phases] = {};
+
+  /// Number of transfers performed with this plan
+  int n_transfers = 0;
+};
+
+/**
+ * Get the plan for transfers of the nekRS solution onto the mesh mirror, building it if needed
+ * @param[in] volume whether the transfer is for volume (rather than boundary) coupling
+ * @param[in] order enumeration of the mesh mirror order (0 = first, 1 = second, etc.)
+ * @return transfer plan
+ */
+transferPlan & outgoingPlan(const bool volume, const int order);
+
+/**
+ * Whether a plan for transfers of the nekRS solution onto the mesh mirror has been built
+ * @param[in] volume whether the transfer is for volume (rather than boundary) coupling
+ * @param[in] order enumeration of the mesh mirror order (0 = first, 1 = second, etc.)
+ * @return whether the transfer plan exists
+ */
+bool hasOutgoingPlan(const bool volume, const int order);
+
 /**
  * Interpolate the nekRS boundary solution onto the boundary data transfer mesh
  * @param[in] order enumeration of the surface mesh order (0 = first, 1 = second, etc.)
  * @param[in] needs_interpolation whether an interpolation matrix needs to be used to figure out the interpolation
  * @param[in] f field to interpolate
  * @param[out] T interpolated boundary value
+ * @param[in] local whether to only fill T with the elements owned by this rank (without
+ *            communication), instead of the elements owned by all ranks
  */
-void boundarySolution(const int order, const bool needs_interpolation, const field::NekFieldEnum & f, double* T);
+void boundarySolution(const int order, const bool needs_interpolation, const field::NekFieldEnum & f, double* T,
+  const bool local = false);
 
 /**
  * Interpolate the nekRS volume solution onto the volume data transfer mesh
@@ -266,8 +376,11 @@ void boundarySolution(const int order, const bool needs_interpolation, const fie
  * @param[in] needs_interpolation whether an interpolation matrix needs to be used to figure out the interpolation
  * @param[in] f field to interpolate
  * @param[out] T interpolated volume value
+ * @param[in] local whether to only fill T with the elements owned by this rank (without
+ *            communication), instead of the elements owned by all ranks
  */
-void volumeSolution(const int order, const bool needs_interpolation, const field::NekFieldEnum & f, double* T);
+void volumeSolution(const int order, const bool needs_interpolation, const field::NekFieldEnum & f, double* T,
+  const bool local = false);
 
 /**
  * Interpolate the MOOSE flux onto the nekRS mesh
@@ -296,6 +409,18 @@ double fluxIntegral();
  */
 double sourceIntegral();
 
+/**
+ * Restore the flux in the scratch space saved before its most recent normalization, so that
+ * elements which are not re-written in a transfer hold the same (un-normalized) flux as elements that are
+ */
+void undoFluxNormalization();
+
+/**
+ * Restore the heat source in the scratch space saved before its most recent normalization, so that
+ * elements which are not re-written in a transfer hold the same (un-normalized) heat source as elements that are
+ */
+void undoHeatSourceNormalization();
+
 /**
  * Normalize the flux sent to nekRS to conserve the total flux
  * @param[in] moose_integral total integrated flux from MOOSE to conserve
@@ -381,12 +506,69 @@ double massFlowrate(const std::vector<int> & boundary_id);
 double sideMassFluxWeightedIntegral(const std::vector<int> & boundary_id, const field::NekFieldEnum & integrand);
 
 /**
- * Compute the heat flux over a set of boundary IDs
+ * Compute the heat flux over a set of boundary IDs. The normal temperature gradient is only
+ * evaluated on the faces of these boundaries, and each face is reused by any other heat flux
+ * integral until the nekRS solution or mesh changes.
  * @param[in] boundary_id nekRS boundary IDs for which to perform the integral
  * @return heat flux area integral
  */
 double heatFluxIntegral(const std::vector<int> & boundary_id);
 
+/// A reduction of the nekRS solution that can be evaluated together with other reductions
+struct reductionRequest
+{
+  // type of reduction
+  reduction::NekReductionEnum type;
+
+  // field to reduce ('velocity_component' is not supported)
+  field::NekFieldEnum field;
+
+  // boundary IDs over which to reduce (unused for volume reductions)
+  std::vector<int> boundary;
+
+  bool operator==(const reductionRequest & other) const
+  {
+    return type == other.type && field == other.field && boundary == other.boundary;
+  }
+};
+
+/**
+ * \brief Evaluate several reductions of the nekRS solution together
+ *
+ * All side reductions over the same set of boundaries are computed in a single pass
+ * over the GLL points on those boundaries, and all volume reductions are computed in a single
+ * pass over the volume GLL points. The partial results from every rank are then combined with
+ * one collective, rather than one collective per reduction.
+ *
+ * The passes can optionally be evaluated with OCCA kernels on the device solution arrays, in
+ * which case only the per-block partial results are copied to the host.
+ * @param[in] requests reductions to evaluate
+ * @param[in] on_device whether to evaluate the reductions on the device
+ * @return dimensional value of each reduction
+ */
+std::vector<double> fusedReductions(const std::vector<reductionRequest> & requests,
+                                    const bool on_device = false);
+
+/**
+ * \brief Integrate several fields over spatial bins with OCCA kernels on the device solution arrays
+ *
+ * The GLL points of the bins are copied to the device (ordered by bin) the first time that they
+ * are used by each owner, and again whenever the owner's point map changes. Each bin is
+ * reduced in a fixed order, so that only one value per bin per field is copied to the host.
+ * @param[in] owner object that owns the point map
+ * @param[in] version version of the owner's point map
+ * @param[in] ids index into the solution arrays of each point
+ * @param[in] bins bin of each point
+ * @param[in] weights mass matrix weight of each point
+ * @param[in] n_bins number of bins
+ * @param[in] fields fields to integrate
+ * @param[out] integrals rank-local (nondimensional) integrals, ordered by bin and then by field
+ */
+void deviceBinnedIntegrals(const void * owner, const int version, const std::vector<int> & ids,
+                           const std::vector<unsigned int> & bins, const std::vector<double> & weights,
+                           const unsigned int n_bins, const std::vector<field::NekFieldEnum> & fields,
+                           double * integrals);
+
 /**
  * Limit the temperature in nekRS to within the range of [min_T, max_T]
  * @param[in] min_T minimum temperature allowable in nekRS
@@ -394,6 +576,36 @@ double heatFluxIntegral(const std::vector<int> & boundary_id);
  */
 void limitTemperature(const double * min_T, const double * max_T);
 
+/// Minimum number of GLL points handled by each task in the threaded host reductions
+constexpr std::size_t min_points_per_task = 1024;
+
+/**
+ * \brief Apply a function to chunks of the items [0, n), distributing the chunks over threads
+ *
+ * Threads are controlled with the usual MOOSE '--n-threads' option; with one thread, the
+ * chunks are visited in order on the calling thread.
+ * @param[in] n number of items
+ * @param[in] grain minimum number of items in each chunk
+ * @param[in] f function applied to the items [begin, end) of one chunk
+ */
+void threadedFor(const std::size_t n, const std::size_t grain,
+                 const std::function<void(std::size_t, std::size_t)> & f);
+
+/**
+ * \brief Sum contributions from the items [0, n), distributing the items over threads
+ *
+ * Each chunk of items accumulates into its own partial sums. The chunks only depend on the
+ * number of items and sums (never on the number of threads), and the partial sums are
+ * combined in chunk order, so the sums are identical to the bit for any number of threads.
+ * @param[in] n number of items
+ * @param[in] grain minimum number of items in each chunk
+ * @param[in] n_values number of sums
+ * @param[in] add function adding the contributions of the items [begin, end) to the partial sums
+ * @param[out] sum sums over all the items, of length n_values
+ */
+void threadedSum(const std::size_t n, const std::size_t grain, const std::size_t n_values,
+                 const std::function<void(std::size_t, std::size_t, double *)> & add, double * sum);
+
 /**
  * Compute the gradient of a volume field
  * @param[in] offset in the gradient field for each component (grad_x, grad_y, or grad_z)
@@ -478,6 +690,9 @@ struct volumeCoupling
   // total number of coupling elements
   int total_n_elems;
 
+  // offset into the element and process arrays where this rank's data begins
+  int offset;
+
   /**
    * nekRS process owning the global element in the data transfer mesh
    * @param[in] elem_id element ID
@@ -521,6 +736,37 @@ struct boundaryCoupling
   int processor_id(const int elem_id) { return process[elem_id]; }
 };
 
+/**
+ * \brief Flat lists of the rank-local GLL points on a set of boundaries
+ *
+ * Because the boundary IDs in nekRS never change, these lists are built once for each
+ * set of boundaries and then reused by all side reductions, so that a side reduction
+ * only touches the GLL points on the boundary.
+ */
+struct boundaryPoints
+{
+  // volume GLL index of each point on the boundaries (i.e. the vmapM entry)
+  std::vector<int> vol_id;
+
+  // offset into the surface geometric factors (sgeo) for each point on the boundaries
+  std::vector<int> sgeo_offset;
+
+  // (nondimensional) area of the boundaries, summed over all ranks
+  double area;
+
+  // whether 'area' has been computed
+  bool area_valid = false;
+};
+
+/**
+ * Get the flat lists of rank-local GLL points on a set of boundaries, building them on
+ * first access for that set of boundaries. The order of 'boundary_id' does not matter.
+ * @param[in] mesh nekRS mesh containing the boundaries
+ * @param[in] boundary_id boundary IDs
+ * @return boundary points
+ */
+boundaryPoints & cachedBoundaryPoints(mesh_t * mesh, const std::vector<int> & boundary_id);
+
 /**
  * Sideset ID corresponding to a given volume element with give local face ID
  * @param[in] elem_id element local rank ID
@@ -616,6 +862,32 @@ int VolumeElemProcessorID(const int elem_id);
  */
 int BoundaryElemProcessorID(const int elem_id);
 
+/**
+ * Number of volume elements in the data transfer mesh owned by this rank
+ * @return number of rank-local volume elements
+ */
+int NlocalVolumeElems();
+
+/**
+ * Number of boundary elements in the data transfer mesh owned by this rank
+ * @return number of rank-local boundary elements
+ */
+int NlocalBoundaryElems();
+
+/**
+ * Global ID of the first volume element in the data transfer mesh owned by this rank;
+ * the elements owned by each rank are numbered contiguously
+ * @return first rank-local volume element ID
+ */
+int VolumeElemOffset();
+
+/**
+ * Global ID of the first boundary element in the data transfer mesh owned by this rank;
+ * the elements owned by each rank are numbered contiguously
+ * @return first rank-local boundary element ID
+ */
+int BoundaryElemOffset();
+
 /**
  * Store the rank-local element, element-local face, and rank ownership for boundary coupling
  * @param[in] boundary_id boundaries through which nekRS will be coupled
@@ -688,6 +960,74 @@ struct characteristicScales
   bool nondimensional_T;
 };
 
+/**
+ * \brief Contiguous view of a field on the GLL points, with the scales needed to dimensionalize it
+ *
+ * Fields that nekRS stores (velocity components, temperature, pressure) point directly into
+ * the nekRS host arrays; fields that are computed (velocity magnitude, unity) point into a
+ * buffer that is materialized at most once per time step. In both cases, the data is indexed
+ * by GLL index with unit stride so that loops over the GLL points can be vectorized.
+ */
+struct fieldSpan
+{
+  // nondimensional field values, indexed by GLL index
+  const double * data;
+
+  // multiplier to dimensionalize the field
+  double scale;
+
+  // shift to add after scaling to dimensionalize the field (nonzero only for temperature)
+  double offset;
+
+  /**
+   * Get the (nondimensional) field at given GLL index
+   * @param[in] id GLL index
+   * @return field value at index
+   */
+  double operator[](const int id) const { return data[id]; }
+
+  /**
+   * Get the dimensional field at given GLL index
+   * @param[in] id GLL index
+   * @return dimensional field value at index
+   */
+  double dimensional(const int id) const { return data[id] * scale + offset; }
+};
+
+/**
+ * Get a contiguous view of a field, materializing it first if it is computed rather than stored
+ * @param[in] field field to view
+ * @return view of the field
+ */
+fieldSpan span(const field::NekFieldEnum & field);
+
+/**
+ * Mark all computed fields as out of date; this must be called whenever the nekRS solution
+ * on the host changes so that computed fields are re-materialized on their next access
+ */
+void invalidateComputedFields();
+
+/// Free the buffers holding computed fields
+void freeComputedFields();
+
+/**
+ * Defer the copy of the nekRS solution from device to host until the host solution is
+ * next read (with copyToHost), or skip it entirely if the host solution is never read
+ * @param[in] time time at which to copy the solution
+ * @param[in] tstep time step index at which to copy the solution
+ */
+void deferHostCopy(const double time, const int tstep);
+
+/// Perform the copy of the nekRS solution from device to host, if one has been deferred
+void copyToHost();
+
+/**
+ * Get a counter of the number of times that the nekRS solution on the host has changed,
+ * which can be used to determine whether quantities computed from the solution are out of date
+ * @return solution version
+ */
+int version();
+
 /**
  * Get pointer to various solution functions (for reading only) based on enumeration
  * @param[in] field field to return a pointer to
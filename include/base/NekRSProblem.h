@@ -124,7 +124,60 @@ public:
 protected:
   virtual void addTemperatureVariable() override { return; }
 
-  std::unique_ptr<NumericVector<Number>> _serialized_solution;
+  /**
+   * \brief Values of the variables sent into nekRS, for the elements written by this rank
+   *
+   * Each rank only writes the incoming data for the mesh mirror elements whose nekRS elements
+   * it owns, so only the DOFs on those elements are gathered from the auxiliary solution. The
+   * values from the previous transfer are retained so that elements with unchanged incoming
+   * data can skip the interpolation onto the nekRS GLL points.
+   */
+  struct IncomingData
+  {
+    /// Mesh mirror elements whose incoming data is written by this rank
+    std::vector<unsigned int> elems;
+
+    /// Number of variables gathered for each element
+    unsigned int n_vars = 0;
+
+    /// Number of vertices per element
+    unsigned int n_vertices = 0;
+
+    /// DOF indices, ordered by element, then by variable, then by vertex
+    std::vector<numeric_index_type> dofs;
+
+    /// Values at the DOFs from the current transfer
+    std::vector<Number> values;
+
+    /// Values at the DOFs from the previous transfer
+    std::vector<Number> previous;
+  };
+
+  /**
+   * Find the elements whose incoming data is written by this rank, and the DOFs on them
+   * @param[in] vars variables sent into nekRS
+   * @param[in] boundary whether the data is written on the boundary (rather than volume) elements
+   * @param[in] coupled_faces_only whether to only include volume elements with faces on the coupling boundaries
+   * @param[out] data incoming data to initialize
+   */
+  void initializeIncomingData(const std::vector<unsigned int> & vars, const bool boundary,
+                              const bool coupled_faces_only, IncomingData & data) const;
+
+  /**
+   * Gather the incoming variables at the DOFs needed by this rank
+   * @param[in,out] data incoming data
+   * @return whether the incoming data on each element changed since the previous transfer
+   */
+  std::vector<bool> localizeIncomingData(IncomingData & data) const;
+
+  /// Incoming heat flux
+  IncomingData _flux_data;
+
+  /// Incoming heat source
+  IncomingData _source_data;
+
+  /// Incoming mesh displacements
+  IncomingData _displacement_data;
 
   /// Whether the problem is a moving mesh problem i.e. with on-the-fly mesh deformation enabled
   const bool & _moving_mesh;
@@ -178,6 +231,13 @@ protected:
   /// Whether a heat source will be applied to NekRS from MOOSE
   const bool & _has_heat_source;
 
+  /**
+   * Whether to skip re-writing the incoming flux and heat source on elements whose
+   * values have not changed since the previous transfer; this is only turned off
+   * to compare against a full re-write in testing
+   */
+  const bool & _skip_unchanged_elements;
+
   /**
    * \brief Total surface-integrated flux coming from the coupled MOOSE app.
    *
@@ -253,7 +313,4 @@ protected:
 
   /// Postprocessor containing the signal of when a synchronization has occurred
   const PostprocessorValue * _transfer_in = nullptr;
-
-  /// flag to indicate whether this is the first pass to serialize the solution
-  static bool _first;
 };
@@ -21,9 +21,11 @@
 #include "ExternalProblem.h"
 #include "NekTimeStepper.h"
 #include "NekRSMesh.h"
+#include "NekInterface.h"
 #include "Transient.h"
 
 #include <memory>
+#include <set>
 
 /**
  * Base class for all MOOSE wrappings of NekRS. This class is used to facilitate
@@ -74,17 +76,45 @@ public:
    */
   virtual bool nondimensional() const { return _nondimensional; }
 
+  /**
+   * Whether the reductions in Nek postprocessors and userobjects are evaluated on the device
+   * @return whether reductions are evaluated on the device
+   */
+  bool deviceReductions() const { return _device_reductions; }
+
   /**
    * Whether the mesh is moving
    * @return whether the mesh is moving
    */
   virtual bool movingMesh() const = 0;
 
+  /**
+   * \brief Register a reduction of the NekRS solution to be evaluated together with all others
+   *
+   * Rather than each Nek postprocessor sweeping over the mesh and performing its own
+   * collective, postprocessors register their reductions here. When the value of any
+   * out-of-date reduction is requested, all the out-of-date reductions that execute on the
+   * current flag are evaluated together with nekrs::fusedReductions. Identical reductions
+   * requested by different objects are only evaluated once.
+   * @param[in] request reduction to evaluate
+   * @param[in] execute_on execution flags of the object requesting the reduction
+   * @return index of the reduction
+   */
+  unsigned int addReduction(const nekrs::reductionRequest & request, const ExecFlagEnum & execute_on);
+
+  /**
+   * Get the value of a registered reduction, evaluating the reductions if out of date
+   * @param[in] index reduction index
+   * @return dimensional value of the reduction
+   */
+  Real reductionValue(const unsigned int index);
+
 protected:
   /**
    * Fill an outgoing auxiliary variable field with nekRS solution data
    * \param[in] var_number auxiliary variable number
-   * \param[in] value nekRS solution data to fill the variable with
+   * \param[in] value nekRS solution data to fill the variable with, for the _n_local_elems
+   *            elements beginning at _first_local_elem
    */
   virtual void fillAuxVariable(const unsigned int var_number, const double * value);
 
@@ -93,6 +123,9 @@ protected:
    */
   virtual void extractOutputs();
 
+  /// Print the time spent in each phase of the transfers of the NekRS solution onto the mesh mirror
+  void printTransferTimings() const;
+
   /**
    * Get the parameters for the external variables to be added
    * @return external variable parameters
@@ -179,6 +212,18 @@ protected:
   /// Whether to turn off all field file writing
   const bool & _disable_fld_file_output;
 
+  /**
+   * \brief Whether to evaluate the reductions in Nek postprocessors on the device
+   *
+   * When true, the copy of the NekRS solution from device to host is deferred until the
+   * host solution is actually read, so that steps which neither output nor read the host
+   * solution avoid the copy entirely.
+   */
+  const bool & _device_reductions;
+
+  /// Whether to print the time spent in each phase of the outgoing transfers
+  const bool & _print_transfer_timings;
+
   /// Number of surface elements in the data transfer mesh, across all processes
   int _n_surface_elems;
 
@@ -245,6 +290,33 @@ protected:
   /// Scratch space to place external NekRS fields before writing into auxiliary variables
   double * _external_data = nullptr;
 
-  /// Number of points for interpolated fields on the MOOSE mesh
+  /**
+   * \brief Whether each rank only extracts the NekRS solution for the elements it owns
+   *
+   * This is true when the mesh mirror is distributed, in which case the mesh mirror is
+   * partitioned to match the NekRS element ownership. Otherwise, the solution for all
+   * elements is gathered onto every rank.
+   */
+  bool _rank_local_transfers;
+
+  /// Number of elements in the data transfer mesh for which this rank holds interpolated fields
+  int _n_local_elems;
+
+  /// ID of the first element in the data transfer mesh for which this rank holds interpolated fields
+  int _first_local_elem;
+
+  /// Number of points for interpolated fields on the MOOSE mesh held by this rank
   int _n_points;
+
+  /// Reductions registered by postprocessors for evaluation with nekrs::fusedReductions
+  std::vector<nekrs::reductionRequest> _reductions;
+
+  /// Execution flags on which each reduction is needed
+  std::vector<std::set<ExecFlagType>> _reduction_execute_on;
+
+  /// Most recently computed value of each reduction
+  std::vector<Real> _reduction_values;
+
+  /// Version of the NekRS solution for which each reduction was last computed
+  std::vector<int> _reduction_version;
 };
@@ -28,6 +28,12 @@
 #include "openmc/tallies/tally.h"
 #include "CardinalEnums.h"
 
+#include "libmesh/simple_range.h"
+#include "libmesh/stored_range.h"
+
+#include <array>
+#include <fstream>
+
 /**
  * Mapping of OpenMC to a collection of MOOSE elements, with temperature feedback
  * on solid cells and both temperature and density feedback on fluid cells. The
@@ -93,32 +99,13 @@ public:
   virtual bool converged() override { return true; }
 
   /**
-   * This class uses elem->volume() in order to normalize the fission power produced
-   * by OpenMC to conserve the specified power. However, as discussed on the MOOSE
-   * slack channel,
-   *
-   * "elem->volume() is expensive, so whenever we do integration in moose we set
-   *  _current_elem_volume to the volume as set by the sum of the quadrature weights"
-   *
-   * "The quadrature rule that we provide when you only have CONSTANT MONOMIALS is "
-   * "insufficient for exactly integrating the element Jacobian mapping type (which "
-   * "is FIRST LAGRANGE for a first order element), so you get an error relative to "
-   * "the libmesh volume computation"
-   *
-   * So, we need to make sure that a minimum order quadrature rule is used with this
-   * class so that the total heat source as computed by an
-   * ElementIntegralVariablePostprocessor actually matches the specified 'power'
-   * (for low quadrature orders, there can be an error up to about 5% or so in total
-   * power). This override simply forces the volume quadrature order to be 2 or higher
-   * when using Gauss (default), monomial, or Gauss-Lobatto quadrature.
-   *
-   * For other quadrature rules, the approximations made in elem->volume() are never
-   * going to match the volume integrations in MOOSE (unless the quadrature order is
-   * very very high). For these orders, we print an error message informing the user
-   * that they should switch to a different order.
+   * Compute the volumes of the mesh mirror elements with the MOOSE quadrature rules, which
+   * are used to normalize the fission power produced by OpenMC. Because these volumes are the
+   * sums of the same quadrature weights used for MOOSE's volume integrations, the total heat
+   * source computed by an ElementIntegralVariablePostprocessor matches the specified 'power'
+   * for any quadrature rule.
    */
-  virtual void createQRules(QuadratureType type, Order order, Order volume_order, Order face_order, SubdomainID block,
-    bool allow_negative_weights = true) override;
+  virtual void initialSetup() override;
 
   /**
    * Type definition for storing the relevant aspects of the OpenMC geometry; the first
@@ -132,6 +119,12 @@ public:
    */
   typedef std::unordered_map<int32_t, std::vector<int32_t>> containedCells;
 
+  /// Type definition for a range of MOOSE element IDs
+  typedef SimpleRange<std::vector<unsigned int>::const_iterator> elemRange;
+
+  /// Type definition for a threaded range of coupled cell indices
+  typedef StoredRange<std::vector<unsigned int>::const_iterator, unsigned int> CellRange;
+
   /**
    * Set the number of particles to run for a Monte Carlo calculation
    * @param[in] n number of particles
@@ -181,14 +174,14 @@ public:
    * @param[in] cell_info cell index, instance pair
    * @return material index
    */
-  int32_t cellToMaterialIndex(const cellInfo & cell_info) { return _cell_to_material[cell_info]; }
+  int32_t cellToMaterialIndex(const cellInfo & cell_info) const { return _cell_to_material[coupledCellIndex(cell_info)]; }
 
   /**
    * Get the first material cell contained in the given cell
    * @param[in] cell_info cell index, instance pair
    * @return material cell index, instance pair
    */
-  cellInfo containedMaterialCell(const cellInfo & cell_info);
+  cellInfo containedMaterialCell(const cellInfo & cell_info) const;
 
   /**
    * Get the fields coupled for each cell; because we require that each cell map to a single phase,
@@ -198,7 +191,15 @@ public:
    * @param[in] cell_info cell index, instance pair
    * @return coupling fields
    */
-  const coupling::CouplingFields cellCouplingFields(const cellInfo & cell_info);
+  const coupling::CouplingFields cellCouplingFields(const cellInfo & cell_info) const;
+
+  /**
+   * Get the index of a cell among the cells coupled to the [Mesh], which indexes all of the
+   * per-cell coupling data
+   * @param[in] cell_info cell index, instance pair
+   * @return coupled cell index, or UNMAPPED if the cell is not coupled
+   */
+  int32_t coupledCellIndex(const cellInfo & cell_info) const;
 
   /**
    * Get the cell ID
@@ -248,7 +249,7 @@ public:
    * the temperature of the first material-type cell
    * @param[in] cell info cell ID, instance
    */
-  double cellTemperature(const cellInfo & cell_info);
+  double cellTemperature(const cellInfo & cell_info) const;
 
   /**
    * Compute relative error
@@ -258,6 +259,16 @@ public:
    */
   Real relativeError(const Real & sum, const Real & sum_sq, const int & n_realizations) const;
 
+  /**
+   * Compute statistics of the relative errors of the local kappa-fission tally bins; bins
+   * without any scores are skipped
+   * @param[out] max_rel_err maximum relative error
+   * @param[out] min_rel_err minimum relative error
+   * @param[out] mean_rel_err mean relative error
+   * @return number of tally bins with scores
+   */
+  unsigned int tallyRelativeErrors(Real & max_rel_err, Real & min_rel_err, Real & mean_rel_err) const;
+
   /// Constant flag to indicate that a cell/element was unmapped
   static constexpr int32_t UNMAPPED {-1};
 
@@ -286,11 +297,75 @@ protected:
   void cacheContainedCells();
 
   /**
-   * Fill the cached contained cells data structure for a given cell
+   * Find the material cells contained in a given cell
    * @param[in] cell_info cell to find contained material cells for
-   * @param[out] map contained cell map
+   * @return contained material cells
+   */
+  containedCells containedMaterialCells(const cellInfo & cell_info) const;
+
+  /**
+   * Flatten the contained material cells of each coupled cell into the contained cell table
+   * @param[in] contained_cells contained material cells, for each coupled cell
+   */
+  void storeContainedCells(const std::vector<std::vector<cellInfo>> & contained_cells);
+
+  /**
+   * Get the number of material cell instances contained in a coupled cell
+   * @param[in] c coupled cell index
+   * @return number of contained material cell instances
+   */
+  std::size_t nContainedMaterialCells(const unsigned int & c) const
+  {
+    if (_contained_fill_shift[c] == UNMAPPED)
+      return _contained_material_cell_offsets[c + 1] - _contained_material_cell_offsets[c];
+
+    return _template_fill.size();
+  }
+
+  /**
+   * Get a material cell instance contained in a coupled cell; for cells that use the
+   * template fill, the instance is computed from the template
+   * @param[in] c coupled cell index
+   * @param[in] i index of the contained material cell instance
+   * @return contained material cell
+   */
+  cellInfo containedMaterialCell(const unsigned int & c, const std::size_t & i) const
+  {
+    if (_contained_fill_shift[c] == UNMAPPED)
+      return _contained_material_cells[_contained_material_cell_offsets[c] + i];
+
+    const auto & cell = _template_fill[i];
+    return {cell.first, cell.second + _contained_fill_shift[c] * _template_fill_shifts[i]};
+  }
+
+  /**
+   * Get the cached material cells contained in a coupled cell, grouped by cell index
+   * @param[in] c coupled cell index
+   * @return contained material cells
    */
-  void setContainedCells(const cellInfo & cell_info, std::map<cellInfo, containedCells> & map);
+  containedCells cachedContainedCells(const unsigned int & c) const;
+
+  /**
+   * Get the MOOSE elements mapped to a coupled cell
+   * @param[in] c coupled cell index
+   * @return element IDs
+   */
+  elemRange cellElems(const unsigned int c) const
+  {
+    return elemRange(_cell_to_elem.begin() + _cell_to_elem_offsets[c],
+                     _cell_to_elem.begin() + _cell_to_elem_offsets[c + 1]);
+  }
+
+  /**
+   * Get the phase of a coupled cell; because we require that each cell map to a single phase,
+   * we simply look up the phase of the first element that this cell maps to
+   * @param[in] c coupled cell index
+   * @return coupling fields
+   */
+  coupling::CouplingFields cellPhase(const unsigned int c) const
+  {
+    return _elem_phase[_cell_to_elem[_cell_to_elem_offsets[c]]];
+  }
 
   /**
    * Check that the structure of the contained material cells for two tally cells matches;
@@ -303,13 +378,6 @@ protected:
   void checkContainedCellsStructure(const cellInfo & cell_info, containedCells & reference,
     containedCells & compare);
 
-  /**
-   * Set a minimum order for a volume quadrature rule
-   * @param[in] volume_order order of the volume quadrature rule
-   * @param[in] type string type of quadrature rule for printing a console message
-   */
-  void setMinimumVolumeQRules(Order & volume_order, const std::string & type);
-
   /// For keeping the output neat when using verbose
   std::string printNewline() { if (_verbose) return "\n"; else return ""; }
 
@@ -362,7 +430,12 @@ protected:
    */
   double tallySum(std::vector<openmc::Tally *> tally) const;
 
-  void relaxAndNormalizeHeatSource(const int & t);
+  /**
+   * Normalize the scores of a local tally by the kappa-fission tally sum and relax them
+   * with the results of the previous fixed point iteration
+   * @param[in] t local tally index
+   */
+  void relaxAndNormalizeTally(const int & t);
 
   /**
    * Loop over all the OpenMC cells and count the number of MOOSE elements to which the cell
@@ -373,12 +446,31 @@ protected:
    */
   void checkCellMappedPhase();
 
+  /**
+   * Count the number of MOOSE elements of each phase to which a coupled cell is mapped
+   * @param[in] c coupled cell index
+   * @param[out] n_solid number of solid elements
+   * @param[out] n_fluid number of fluid elements
+   * @param[out] n_none number of uncoupled elements
+   */
+  void cellMappedPhases(const unsigned int & c, int & n_solid, int & n_fluid, int & n_none) const;
+
+  /**
+   * Print the number of MOOSE elements of each phase to which a coupled cell is mapped
+   * @param[in] c coupled cell index
+   * @return descriptive string
+   */
+  std::string printCellMappedPhases(const unsigned int & c) const;
+
   /**
    * Loop over all the OpenMC cells and find those for which we should add tallies. If the cell
    * doesn't have fissile material, we will also print a warning for single-level geoemtries.
    */
   void storeTallyCells();
 
+  /// Check that all of the tallied cells map to MOOSE regions of equal volume
+  void checkEqualMappedTallyVolumes() const;
+
   /**
    * Check that the same MOOSE block ID doesn't apepar in both the 'fluid_blocks' and 'solid_blocks',
    * or else it's not clear whether that block should exchange temperature and density with MOOSE
@@ -399,10 +491,45 @@ protected:
    */
   void computeCellMappedVolumes();
 
+  /**
+   * Compute the volume of each MOOSE element as the sum of the quadrature weights that MOOSE
+   * uses for volume integrations; the elements are split across ranks and threads
+   */
+  void computeElemVolumes();
+
   /// Set up the mapping from MOOSE elements to OpenMC cells
   void initializeElementToCellMapping();
 
-  /// Populate maps of MOOSE elements to OpenMC cells
+  /**
+   * Find the OpenMC cells coupled to the MOOSE elements and the elements mapped to each,
+   * and count the number of mapped elements in each phase, from the element-to-cell mapping
+   */
+  void storeCellToElemMapping();
+
+  /**
+   * Compute the hashes identifying the mesh, the OpenMC geometry, and the coupling settings
+   * for which a mapping cache is valid
+   * @return hashes of the mesh, geometry, and coupling settings
+   */
+  std::array<uint64_t, 3> mappingCacheKey() const;
+
+  /**
+   * Read the element-to-cell mapping and contained material cells from
+   * the mapping cache, if it exists and was written for the same mesh, geometry, and settings
+   * @return whether the mapping was read from the cache
+   */
+  bool readMappingCache();
+
+  /// Write the element-to-cell mapping and contained material cells to the mapping cache
+  void writeMappingCache() const;
+
+  /**
+   * Populate maps of MOOSE elements to OpenMC cells. Each rank searches the OpenMC geometry
+   * for a contiguous partition of the elements (split further across threads), after which the
+   * cell instances are computed from the saved geometry paths and the results are gathered
+   * to all ranks. If any non-material cells are mapped, the distributed cell offsets are
+   * prepared for the mapped cells before computing the instances.
+   */
   void mapElemsToCells();
 
   /// Add tallies for the fluid and/or solid cells
@@ -415,9 +542,10 @@ protected:
    * Check whether the power in a particular tally bin is zero, which will throw
    * an error if 'check_zero_tallies = true'.
    * @param[in] power_fraction fractional power of the bin
-   * @param[in] descriptor string to use in formatting the error message content
+   * @param[in] t local tally index
+   * @param[in] b bin index within the local tally
    */
-  void checkZeroTally(const Real & power_fraction, const std::string & descriptor) const;
+  void checkZeroTally(const Real & power_fraction, const unsigned int & t, const std::size_t & b) const;
 
   /**
    * Send temperature from MOOSE to the OpenMC cells by computing a volume average
@@ -425,6 +553,35 @@ protected:
    */
   void sendTemperatureToOpenMC();
 
+  /**
+   * Find the DOF indices of the transferred variables on the coupled elements, and make sure
+   * each contained material cell holds one temperature per instance so that the temperatures
+   * can be written directly; these only need to be set up once, before the first transfer
+   */
+  void initializeTransferData();
+
+  /**
+   * Get a range over all of the coupled cells, for splitting loops over the cells across threads
+   * @return coupled cell range
+   */
+  CellRange cellRange() const;
+
+  /**
+   * Find the DOF index of an elemental variable on each element in _cell_to_elem
+   * @param[in] var_num variable number
+   * @param[out] dofs DOF indices (invalid for elements not on this process)
+   */
+  void cellElemDofs(const unsigned int & var_num, std::vector<dof_id_type> & dofs) const;
+
+  /**
+   * Compute the volume average of an elemental variable over the elements mapped to each
+   * coupled cell; the cells are split across threads
+   * @param[in] dofs DOF index of the variable on each element in _cell_to_elem
+   * @param[in] fluid_only whether to only compute the averages for the fluid cells
+   * @return volume average for each coupled cell (zero for skipped cells)
+   */
+  std::vector<Real> cellAverages(const std::vector<dof_id_type> & dofs, const bool fluid_only) const;
+
   /**
    * Send density from MOOSE to the fluid OpenMC cells by computing a volume average
    * and applying a single density per OpenMC cell.
@@ -443,6 +600,20 @@ protected:
    */
   void getFissionTallyStandardDeviationFromOpenMC(const unsigned int & var_num);
 
+  /**
+   * Get a (relaxed) score of the local tallies as a volumetric rate and store into variable
+   * @param[in] var_num variable number to store the score in
+   * @param[in] score OpenMC score name
+   */
+  void getTallyScoreFromOpenMC(const unsigned int & var_num, const std::string & score);
+
+  /**
+   * OpenMC score name for an output field
+   * @param[in] output output field
+   * @return score name
+   */
+  std::string tallyScore(std::string output) const;
+
   /**
    * Normalize the local tally by either the global kappa fission tally, or the sum
    * of the local kappa fission tally
@@ -452,15 +623,15 @@ protected:
   Real normalizeLocalTally(const Real & tally_result) const;
 
   /**
-   * Normalize the local tally by either the global kappa fission tally, or the sum
-   * of the local kappa fission tally
-   * @param[in] raw_tally value of tally result
-   * @return normalized tally
+   * Get a descriptive string for a local tally bin, for printing messages
+   * @param[in] t local tally index
+   * @param[in] b bin index within the local tally
+   * @return descriptive string
    */
-  xt::xtensor<double, 1> normalizeLocalTally(const xt::xtensor<double, 1> & raw_tally) const;
+  std::string printTallyBin(const unsigned int & t, const std::size_t & b) const;
 
   /**
-   * Add the local kappa-fission tally
+   * Add a local tally with the kappa-fission score and any additional output scores
    * @param[in] filters tally filters
    * @param[in] estimator estimator type
    */
@@ -479,11 +650,37 @@ protected:
   void fillMeshTranslations();
 
   /**
-   * Find the OpenMC cell at a given point in space in terms of the _particle members
+   * Find the OpenMC cell at a given point in space in terms of the particle members
+   * @param[in,out] particle particle to use for the geometry search
    * @param[in] point point
    * @return whether OpenMC reported an error
    */
-  bool findCell(const Point & point);
+  bool findCell(openmc::Particle & particle, const Point & point) const;
+
+  /**
+   * Geometry state on one coordinate level of the OpenMC cell found at an element centroid;
+   * this is all that is needed to (re)compute the cell instance without repeating the search
+   */
+  struct coordLevel
+  {
+    /// cell index on this level
+    int32_t cell;
+
+    /// lattice index on this level
+    int32_t lattice;
+
+    /// lattice indices on this level
+    int lattice_i[3];
+  };
+
+  /**
+   * Compute the instance of the cell at the end of a geometry path
+   * @param[in,out] particle particle to use for rebuilding the coordinate levels
+   * @param[in] path geometry state on each coordinate level, down to the cell
+   * @param[in] level coordinate level of the cell
+   * @return cell instance
+   */
+  int32_t cellInstance(openmc::Particle & particle, const coordLevel * path, const int level) const;
 
   /**
    * Get the fill of an OpenMC cell
@@ -503,26 +700,42 @@ protected:
   bool cellHasFissileMaterials(const cellInfo & cell_info) const;
 
   /**
-   * Set an auxiliary elemental variable to a specified value
+   * Number the bins of all the local tallies consecutively, and find the MOOSE volume and
+   * the local elements to which each bin maps; this only needs to be done once, after the
+   * element volumes are computed
+   */
+  void initializeTallyScatter();
+
+  /**
+   * Get the DOF indices of an elemental variable on the local elements mapped to the tally bins,
+   * ordered by tally bin; these are found the first time they are needed for each variable
    * @param[in] var_num variable number
-   * @param[in] elem_ids element IDs to set
-   * @param[in] value value to set
+   * @return DOF indices
    */
-  void fillElementalAuxVariable(const unsigned int & var_num, const std::vector<unsigned int> & elem_ids, const Real & value);
+  const std::vector<numeric_index_type> & tallyBinDofs(const unsigned int & var_num);
+
+  /**
+   * Set an auxiliary elemental variable to a value for each tally bin, on all the local
+   * elements mapped to that bin, with a single insertion into the auxiliary solution
+   * @param[in] var_num variable number
+   * @param[in] values value for each tally bin
+   */
+  void fillAuxVariableFromTallyBins(const unsigned int & var_num, const std::vector<Real> & values);
 
   /// Extract user-specified additional output fields from OpenMC
   void extractOutputs();
 
   /**
    * Checks that the contained material cells exactly match between a reference obtained
-   * by calling openmc::Cell::get_contained_cells for each tally cell and a shortcut
+   * by calling openmc::Cell::get_contained_cells for a tally cell and a shortcut
    * approach that assumes all tally cells (which aren't simply just material fills)
    * has exactly the same contained material cells.
-   * @param[in] reference reference map to compare against
-   * @param[in] compare shortcut map to compare
+   * @param[in] cell_info tally cell information for printing error messages
+   * @param[in] reference reference contained cells to compare against
+   * @param[in] compare shortcut contained cells to compare
    */
-  void compareContainedCells(std::map<cellInfo, containedCells> & reference,
-    std::map<cellInfo, containedCells> & compare);
+  void compareContainedCells(const cellInfo & cell_info, containedCells & reference,
+    containedCells & compare);
 
   std::unique_ptr<NumericVector<Number>> _serialized_solution;
 
@@ -679,6 +892,36 @@ protected:
   /// Constant relaxation factor
   const Real & _relaxation_factor;
 
+  /// Tally relative error used to choose the number of particles before each OpenMC run
+  const particle_control::ParticleControlEnum _particle_control;
+
+  /// Whether to add a relative error trigger to the local tallies
+  const bool & _use_tally_triggers;
+
+  /// Relative error of the kappa-fission tally to target
+  Real _target_relative_error;
+
+  /// Minimum number of particles per batch when using particle control
+  int64_t _min_particles;
+
+  /// Maximum number of particles per batch when using particle control
+  int64_t _max_particles;
+
+  /// Maximum kappa-fission tally relative error at which to stop a run early (zero if unused)
+  const Real _batch_relative_error;
+
+  /// Standard deviation of k-eff at which to stop a run early (zero if unused)
+  const Real _batch_k_std_dev;
+
+  /// Minimum number of active batches before stopping a run early
+  const unsigned int & _min_active_batches;
+
+  /// Whether to run OpenMC one batch at a time, rather than with openmc_run
+  const bool _run_by_batch;
+
+  /// Per-batch log of the OpenMC runs, only open on the root rank
+  std::ofstream _batch_log;
+
   /**
    * If known a priori by the user, whether the tally cells (which are not simply material
    * fills) have EXACTLY the same contained material cells. This is a big optimization for
@@ -721,6 +964,16 @@ protected:
    */
   const bool & _check_identical_tally_cell_fills;
 
+  /**
+   * File in which to cache the element-to-cell mapping and the contained material cells;
+   * initializing the mapping for large TRISO models can take several minutes, which can be
+   * skipped on restarts if the mesh, OpenMC geometry, and coupling settings are unchanged. Empty if no cache is used.
+   */
+  const std::string _mapping_cache;
+
+  /// Whether the element-to-cell mapping was read from the mapping cache
+  bool _read_mapping_cache {false};
+
   /**
    * Whether the problem has fluid blocks specified; note that this is NOT necessarily
    * indicative that the mapping was successful in finding any cells corresponding to those blocks
@@ -793,23 +1046,65 @@ protected:
   /// Whether non-material cells are mapped
   bool _material_cells_only {true};
 
-  /// Mapping of OpenMC cell indices to a vector of MOOSE element IDs
-  std::map<cellInfo, std::vector<unsigned int>> _cell_to_elem;
+  /**
+   * OpenMC cells that are coupled by feedback to the MOOSE elements, in ascending order.
+   * The position of a cell in this vector is its coupled cell index, which indexes all of
+   * the other per-cell data below so that the loops in the transfers are over flat arrays.
+   */
+  std::vector<cellInfo> _coupled_cells;
+
+  /// Offsets into _cell_to_elem of the elements mapped to each coupled cell
+  std::vector<unsigned int> _cell_to_elem_offsets;
+
+  /// MOOSE element IDs mapped to the coupled cells, ordered by coupled cell index
+  std::vector<unsigned int> _cell_to_elem;
 
-  /// Whether a cell index, instance pair should be added to the tally filter
-  std::map<cellInfo, bool> _cell_has_tally;
+  /// Whether each coupled cell should be added to the tally filter
+  std::vector<bool> _cell_has_tally;
 
   /**
-   * Volume associated with the mapped element space for each OpenMC cell; the unit
+   * Volume associated with the mapped element space for each coupled cell; the unit
    * for this volume is whatever is used in the [Mesh] block
    */
-  std::map<cellInfo, Real> _cell_to_elem_volume;
+  std::vector<Real> _cell_to_elem_volume;
+
+  /// Volume of each MOOSE element, computed with the MOOSE quadrature rules
+  std::vector<Real> _elem_volumes;
+
+  /// Material filling each coupled cell (only set for fluid cells)
+  std::vector<int32_t> _cell_to_material;
+
+  /**
+   * Offsets into _contained_material_cells of the material cells contained in each coupled
+   * cell; cells that use the template fill have no entries
+   */
+  std::vector<std::size_t> _contained_material_cell_offsets;
+
+  /// Material-type cells contained within the coupled cells, ordered by coupled cell index
+  std::vector<cellInfo> _contained_material_cells;
+
+  /**
+   * For each coupled cell, the multiple of _template_fill_shifts by which the template fill
+   * is shifted to give the contained material cells; UNMAPPED for cells whose contained
+   * material cells are stored in _contained_material_cells. Only the non-material tally
+   * cells use the template fill, when 'identical_tally_cell_fills' is true.
+   */
+  std::vector<int32_t> _contained_fill_shift;
 
-  /// Material filling each cell
-  std::map<cellInfo, int32_t> _cell_to_material;
+  /// Material-type cells contained within the first non-material tally cell
+  std::vector<cellInfo> _template_fill;
 
-  /// Material-type cells contained within a cell
-  std::map<cellInfo, containedCells> _cell_to_contained_material_cells;
+  /// Difference in instance between each entry in the template fill and the second tally cell
+  std::vector<int32_t> _template_fill_shifts;
+
+  /// Volume of each element in _cell_to_elem, used to weight the cell averages of the transferred fields
+  std::vector<Real> _cell_to_elem_weights;
+
+  /// DOF index of the temperature variable on each element in _cell_to_elem
+  std::vector<dof_id_type> _cell_to_elem_temp_dofs;
+
+  /// DOF index of the density variable on each element in _cell_to_elem
+  std::vector<dof_id_type> _cell_to_elem_density_dofs;
 
   /// OpenMC cells to which a kappa fission tally is to be added
   std::vector<cellInfo> _tally_cells;
@@ -890,9 +1185,6 @@ protected:
   /// ID used by OpenMC to indicate that a material fill is VOID
   static constexpr int MATERIAL_VOID {-1};
 
-  /// Dummy particle to reduce number of allocations of particles for cell lookup routines
-  openmc::Particle _particle;
-
   /**
    * Translations to apply to the mesh template, in the event that the mesh should be
    * repeated throughout the geometry. For instance, in pincell type geometries, you can
@@ -909,6 +1201,9 @@ protected:
   /// Numeric identifiers for the external variables
   std::vector<unsigned int> _external_vars;
 
+  /// Scores of the local tallies; kappa-fission is always first, followed by the output scores
+  std::vector<std::string> _tally_scores = {"kappa-fission"};
+
   /// Spatial dimension of the Monte Carlo problem
   static constexpr int DIMENSION {3};
 
@@ -931,16 +1226,49 @@ protected:
    * q(n+1) = (1-a) * q(n) + a * PHI(q(n), s)
    * where q(n+1) is _current_mean_tally, a is the relaxation factor, q(n)
    * is _previous_mean_tally, and PHI is the most-recently-computed tally result
-   * (available locally in the heat source update function).
+   * (available locally in the heat source update function). Stored by score and then by bin.
    */
-  std::vector<xt::xtensor<double, 1>> _current_mean_tally;
+  std::vector<xt::xtensor<double, 2>> _current_mean_tally;
+
+  /// Previous fixed point iteration tally result (after relaxation), by score and then by bin
+  std::vector<xt::xtensor<double, 2>> _previous_mean_tally;
+
+  /// Offset of the first bin of each local tally, when numbering all the bins consecutively
+  std::vector<std::size_t> _local_tally_bin_offsets;
+
+  /// MOOSE volume to which each tally bin maps
+  std::vector<Real> _tally_bin_volumes;
+
+  /// Offsets into _tally_bin_elems of the local elements mapped to each tally bin
+  std::vector<std::size_t> _tally_bin_elem_offsets;
 
-  /// Previous fixed point iteration tally result (after relaxation)
-  std::vector<xt::xtensor<double, 1>> _previous_mean_tally;
+  /// Local elements mapped to the tally bins, ordered by tally bin
+  std::vector<unsigned int> _tally_bin_elems;
+
+  /// DOF indices of the variables written from the tallies, on each of _tally_bin_elems
+  std::map<unsigned int, std::vector<numeric_index_type>> _tally_bin_dofs;
+
+  /// Value for each tally bin to be written into an auxiliary variable
+  std::vector<Real> _tally_bin_values;
+
+  /// Value for each of _tally_bin_elems to be inserted into the auxiliary solution
+  std::vector<Number> _tally_bin_dof_values;
 
 private:
   /**
    * Update the number of particles according to the Dufek-Gudowski relaxation scheme
    */
   void dufekGudowskiParticleUpdate();
+
+  /**
+   * Update the number of particles so that the relative error of the kappa-fission tally
+   * meets the 'target_relative_error', based on the relative error of the previous run
+   */
+  void tallyErrorParticleUpdate();
+
+  /**
+   * Run OpenMC one batch at a time, writing the batch log and stopping once the
+   * 'batch_relative_error' and 'batch_k_std_dev' criteria are met
+   */
+  void runOpenMCByBatch();
 };
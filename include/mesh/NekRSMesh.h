@@ -56,7 +56,14 @@ public:
 
   virtual std::unique_ptr<MooseMesh> safeClone() const override;
 
-  /// Add all the elements in the mesh to the MOOSE data structures
+  /**
+   * \brief Add all the elements in the mesh to the MOOSE data structures
+   *
+   * If 'merge_nodes' is true, coincident vertices of neighboring elements share a single
+   * node; otherwise, each element receives its own nodes. In both cases, the element IDs
+   * and the element-local node ordering are the same, so the data transfers (which are
+   * performed element-by-element) do not depend on this setting.
+   */
   virtual void addElems();
 
   /**
@@ -95,6 +102,25 @@ public:
    */
   const int & numVerticesPerElem() const { return _n_vertices_per_elem; }
 
+  /**
+   * \brief Get the number of elements in MOOSE's representation of nekRS's mesh owned by this rank
+   *
+   * The elements owned by each rank are numbered contiguously, beginning at firstLocalElem().
+   * This function is used to perform the data transfer routines in NekRSProblem
+   * agnostic of whether we have surface or volume coupling.
+   * return number of rank-local elements
+   */
+  const int & numLocalElems() const { return _n_local_elems; }
+
+  /**
+   * \brief Get the ID of the first element in MOOSE's representation of nekRS's mesh owned by this rank
+   *
+   * This function is used to perform the data transfer routines in NekRSProblem
+   * agnostic of whether we have surface or volume coupling.
+   * return first rank-local element ID
+   */
+  const int & firstLocalElem() const { return _first_local_elem; }
+
   /**
    * \brief Get the libMesh node index from nekRS's GLL index ordering
    *
@@ -206,6 +232,13 @@ protected:
   /// Initialize members for the mesh and determine the GLL-to-node mapping
   void initializeMeshParams();
 
+  /**
+   * Get the distance below which two element vertices are considered coincident when
+   * merging nodes, based on the size of the bounding box of the mesh
+   * @return merge tolerance
+   */
+  Real mergeTolerance() const;
+
   /**
    * \brief Whether nekRS is coupled through volumes to MOOSE
    *
@@ -252,6 +285,19 @@ protected:
    */
   const Real & _scaling;
 
+  /**
+   * \brief Whether to merge coincident vertices of neighboring elements into shared nodes
+   *
+   * By default, each element is given its own copy of its nodes, so that the mesh is
+   * disconnected. Merging the nodes reduces the number of nodes (and hence the number of
+   * degrees of freedom in every nodal variable on this mesh) by up to a factor of 8 for
+   * Hex8 elements and 27 for Hex27 elements.
+   */
+  const bool & _merge_nodes;
+
+  /// Number of distinct nodes created when merging nodes
+  int _n_merged_nodes;
+
   /// Order of the nekRS solution
   int _nek_polynomial_order;
 
@@ -264,6 +310,12 @@ protected:
   /// Number of elements in MooseMesh, which depends on whether building a boundary/volume mesh
   int _n_elems;
 
+  /// Number of elements in MooseMesh owned by this rank, which depends on whether building a boundary/volume mesh
+  int _n_local_elems;
+
+  /// ID of the first element in MooseMesh owned by this rank, which depends on whether building a boundary/volume mesh
+  int _first_local_elem;
+
   /// Function returning the processor id which should own each element
   int (*_elem_processor_id)(const int elem_id);
 
@@ -37,6 +37,12 @@ public:
 
   NekMassFluxWeightedSideAverage(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
   virtual Real getValue() override;
+
+protected:
+  /// Index of the reduction for the mass flowrate
+  unsigned int _mass_flowrate_reduction;
 };
 
@@ -38,6 +38,8 @@ public:
 
   NekMassFluxWeightedSideIntegral(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
   virtual Real getValue() override;
 };
 
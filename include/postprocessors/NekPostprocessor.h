@@ -45,6 +45,24 @@ public:
   virtual void checkValidField(const field::NekFieldEnum & field) const;
 
 protected:
+  /**
+   * Register a reduction of the NekRS solution with the problem, so that it is evaluated
+   * together with the reductions needed by all other Nek postprocessors
+   * @param[in] type type of reduction
+   * @param[in] field field to reduce
+   * @param[in] boundary boundary IDs over which to reduce (unused for volume reductions)
+   * @return index of the reduction
+   */
+  unsigned int addReduction(const reduction::NekReductionEnum & type, const field::NekFieldEnum & field,
+    const std::vector<int> & boundary = {});
+
+  /**
+   * Get the value of a reduction registered with addReduction
+   * @param[in] index index of the reduction
+   * @return dimensional value of the reduction
+   */
+  Real reductionValue(const unsigned int index);
+
   /// Base mesh this postprocessor acts on
   const MooseMesh & _mesh;
 
@@ -55,5 +73,5 @@ protected:
   const NekRSMesh * _nek_mesh;
 
   /// Underlying problem
-  const NekRSProblemBase * _nek_problem;
+  NekRSProblemBase * _nek_problem;
 };
@@ -35,9 +35,14 @@ public:
 
   NekSideAverage(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
   virtual Real getValue() override;
 
 protected:
   /// Area by which to normalize
   Real _area;
+
+  /// Index of the reduction for the area, if the mesh is moving
+  unsigned int _area_reduction;
 };
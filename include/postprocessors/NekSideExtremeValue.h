@@ -35,10 +35,15 @@ public:
 
   NekSideExtremeValue(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
   virtual Real getValue() override;
 
 protected:
   /// type of extrema operation
   const operation::OperationEnum _type;
+
+  /// Index of the reduction for this postprocessor
+  unsigned int _reduction;
 };
 
@@ -35,6 +35,12 @@ public:
 
   NekSideIntegral(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
   virtual Real getValue() override;
+
+protected:
+  /// Indices of the reductions for this postprocessor (the three components for 'velocity_component')
+  std::vector<unsigned int> _reductions;
 };
 
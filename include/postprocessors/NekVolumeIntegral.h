@@ -35,9 +35,17 @@ public:
 
   NekVolumeIntegral(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+
   virtual Real getValue() override;
 
 protected:
   /// Volume by which to normalize
   Real _volume;
+
+  /// Indices of the reductions for this postprocessor (the three components for 'velocity_component')
+  std::vector<unsigned int> _reductions;
+
+  /// Index of the reduction for the volume, if the mesh is moving
+  unsigned int _volume_reduction;
 };
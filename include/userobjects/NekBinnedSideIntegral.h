@@ -37,11 +37,11 @@ public:
   Real spatialValue(const Point & p, const unsigned int & component) const override;
 
   /**
-   * Compute the integral over the side bins
-   * @param[in] integrand field to integrate
-   * @param[out] total_integral integral over each bin
+   * Compute the integrals of several fields over the side bins in a single pass
+   * @param[in] integrands fields to integrate
+   * @param[out] total_integrals integrals, ordered by bin and then by field
    */
-  virtual void binnedSideIntegral(const field::NekFieldEnum & integrand, double * total_integral);
+  virtual void binnedSideIntegral(const std::vector<field::NekFieldEnum> & integrands, double * total_integrals);
 
   /**
    * Compute the integrals
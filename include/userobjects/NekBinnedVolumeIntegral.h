@@ -37,9 +37,9 @@ public:
   virtual void getBinVolumes() override;
 
   /**
-   * Compute a volume integral over the bins
-   * @param[in] integrand field to integrate
-   * @param[out] total_integral integrated values in each bin
+   * Compute volume integrals of several fields over the bins in a single pass
+   * @param[in] integrands fields to integrate
+   * @param[out] total_integrals integrated values, ordered by bin and then by field
    */
-  virtual void binnedVolumeIntegral(const field::NekFieldEnum & integrand, double * total_integral);
+  virtual void binnedVolumeIntegral(const std::vector<field::NekFieldEnum> & integrands, double * total_integrals);
 };
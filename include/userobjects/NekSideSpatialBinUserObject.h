@@ -40,6 +40,13 @@ public:
 
   virtual void gapIndexAndDistance(const Point & point, unsigned int & index, Real & distance) const;
 
+  /**
+   * Only points within half the gap thickness of a gap contribute to the side bins
+   * @param[in] p point
+   * @return whether the point contributes
+   */
+  virtual bool includePoint(const Point & p) const override;
+
 protected:
   /// Width of region enclosing gap for which points contribute to gap integral
   const Real & _gap_thickness;
@@ -78,7 +78,35 @@ public:
    */
   Point nekPoint(const int & local_elem_id, const int & local_node_id) const;
 
+  /**
+   * Whether a point contributes to the bins
+   * @param[in] p point
+   * @return whether the point contributes
+   */
+  virtual bool includePoint(const Point & /* p */) const { return true; }
+
 protected:
+  /**
+   * Map each contributing GLL point to its bin; for a fixed mesh this is only done once,
+   * while for a moving mesh it is redone once per time step (whether nekRS moves its own mesh
+   * or MOOSE sends the deformation)
+   */
+  void updatePointMap();
+
+  /**
+   * Sum the mass matrix weights and the number of contributing points in each bin across
+   * all processes, into _bin_volumes and _bin_counts
+   */
+  void binnedPointVolumes();
+
+  /**
+   * Integrate several fields over the bins in a single pass over the point map, summed
+   * across all processes with a single reduction
+   * @param[in] integrands fields to integrate
+   * @param[out] total_integrals (nondimensional) integrals, ordered by bin and then by field
+   */
+  void binnedPointIntegrals(const std::vector<field::NekFieldEnum> & integrands, double * total_integrals);
+
   /// Get the output points for a single bin
   void computePoints1D();
 
@@ -145,10 +173,11 @@ protected:
   /// values of the userobject in each bin
   double * _bin_values;
 
-  /// temporary storage space to hold the results of component-wise evaluations
-  double * _bin_values_x;
-  double * _bin_values_y;
-  double * _bin_values_z;
+  /// Fields integrated for 'field = velocity_component'
+  static const std::vector<field::NekFieldEnum> _velocity_fields;
+
+  /// Velocity components in each bin for 'field = velocity_component', ordered by bin and then by component
+  double * _bin_velocities;
 
   /// Volumes of each bin
   double * _bin_volumes;
@@ -164,4 +193,22 @@ protected:
 
   /// Partial-sum of bin count per Nek rank
   int * _bin_partial_counts;
+
+  /// Partial-sum of the bin values of several fields per Nek rank, ordered by bin and then by field
+  std::vector<double> _bin_partial_fields;
+
+  /// Indices into the nekRS solution of the GLL points that contribute to the bins
+  std::vector<int> _map_points;
+
+  /// Bin of each contributing GLL point
+  std::vector<unsigned int> _map_bins;
+
+  /// Mass matrix weight of each contributing GLL point
+  std::vector<double> _map_weights;
+
+  /// Number of times the point map has been computed, which identifies it to the device copy
+  int _map_version;
+
+  /// Solution and mesh versions for which the point map was last computed
+  std::pair<int, int> _map_state;
 };
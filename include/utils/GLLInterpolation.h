@@ -0,0 +1,289 @@
+/********************************************************************/
+/*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+/*                             Cardinal                             */
+/*                                                                  */
+/*                  (c) 2021 UChicago Argonne, LLC                  */
+/*                        ALL RIGHTS RESERVED                       */
+/*                                                                  */
+/*                 Prepared by UChicago Argonne, LLC                */
+/*               Under Contract No. DE-AC02-06CH11357               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*             Prepared by Battelle Energy Alliance, LLC            */
+/*               Under Contract No. DE-AC07-05ID14517               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*                 See LICENSE for full restrictions                */
+/********************************************************************/
+
+#pragma once
+
+#include <cstddef>
+
+/**
+ * \brief Tensor-product interpolation kernels between two GLL point sets
+ *
+ * These kernels interpolate data on the Gauss-Lobatto-Legendre points of a hexahedral
+ * element (or quadrilateral face) onto a different set of points along each coordinate
+ * direction by successive application of a 1-D interpolation matrix (sum factorization).
+ * For the combinations of points that are most common in Cardinal (nekRS polynomial orders
+ * of 3 through 9 and mesh mirror orders of 1 and 2), compile-time specializations are
+ * provided so that the inner loops have fixed trip counts and can be vectorized. All
+ * kernels operate on caller-provided scratch space so that no memory is allocated per element.
+ */
+namespace interpolation
+{
+
+/**
+ * Signature for a volume interpolation kernel specialized on the number of points
+ * @param[in] I interpolation matrix
+ * @param[in] x element data to be interpolated
+ * @param[out] Ix interpolated data
+ * @param[in] scratch scratch space of at least volumeScratchSize(N, M) entries
+ */
+typedef void (*VolumeKernel)(const double * I, const double * x, double * Ix, double * scratch);
+
+/**
+ * Signature for a face interpolation kernel specialized on the number of points
+ * @param[in] I interpolation matrix
+ * @param[in] x face data to be interpolated
+ * @param[out] Ix interpolated data
+ * @param[in] scratch scratch space of at least faceScratchSize(N, M) entries
+ */
+typedef void (*FaceKernel)(const double * I, const double * x, double * Ix, double * scratch);
+
+/**
+ * Size of the scratch space needed to interpolate a volume from N to M points in 1-D
+ * @param[in] N number of points in 1-D to be interpolated
+ * @param[in] M resulting number of interpolated points in 1-D
+ * @return number of entries in scratch space
+ */
+inline std::size_t volumeScratchSize(const int N, const int M) { return N * N * M + N * M * M; }
+
+/**
+ * Size of the scratch space needed to interpolate a face from N to M points in 1-D
+ * @param[in] N number of points in 1-D to be interpolated
+ * @param[in] M resulting number of interpolated points in 1-D
+ * @return number of entries in scratch space
+ */
+inline std::size_t faceScratchSize(const int N, const int M) { return N * M; }
+
+/**
+ * Interpolate volume data from N to M points in 1-D, with the number of points known at compile time
+ * @param[in] I interpolation matrix
+ * @param[in] x element data to be interpolated
+ * @param[out] Ix interpolated data
+ * @param[in] scratch scratch space of at least volumeScratchSize(N, M) entries
+ */
+template <int N, int M>
+void
+hexVolume(const double * I, const double * x, double * Ix, double * scratch)
+{
+  double * Ix1 = scratch;
+  double * Ix2 = scratch + N * N * M;
+
+  for (int k = 0; k < N; ++k)
+    for (int j = 0; j < N; ++j)
+    {
+      const double * xkj = x + k * N * N + j * N;
+      for (int i = 0; i < M; ++i)
+      {
+        double tmp = 0.0;
+        for (int n = 0; n < N; ++n)
+          tmp += I[i * N + n] * xkj[n];
+        Ix1[k * N * M + j * M + i] = tmp;
+      }
+    }
+
+  for (int k = 0; k < N; ++k)
+    for (int j = 0; j < M; ++j)
+    {
+      double * out = Ix2 + k * M * M + j * M;
+      for (int i = 0; i < M; ++i)
+        out[i] = 0.0;
+
+      for (int n = 0; n < N; ++n)
+      {
+        const double Ijn = I[j * N + n];
+        const double * in = Ix1 + k * N * M + n * M;
+        for (int i = 0; i < M; ++i)
+          out[i] += Ijn * in[i];
+      }
+    }
+
+  for (int k = 0; k < M; ++k)
+  {
+    double * out = Ix + k * M * M;
+    for (int ji = 0; ji < M * M; ++ji)
+      out[ji] = 0.0;
+
+    for (int n = 0; n < N; ++n)
+    {
+      const double Ikn = I[k * N + n];
+      const double * in = Ix2 + n * M * M;
+      for (int ji = 0; ji < M * M; ++ji)
+        out[ji] += Ikn * in[ji];
+    }
+  }
+}
+
+/**
+ * Interpolate face data from N to M points in 1-D, with the number of points known at compile time
+ * @param[in] I interpolation matrix
+ * @param[in] x face data to be interpolated
+ * @param[out] Ix interpolated data
+ * @param[in] scratch scratch space of at least faceScratchSize(N, M) entries
+ */
+template <int N, int M>
+void
+hexFace(const double * I, const double * x, double * Ix, double * scratch)
+{
+  for (int j = 0; j < N; ++j)
+  {
+    const double * xj = x + j * N;
+    for (int i = 0; i < M; ++i)
+    {
+      double tmp = 0.0;
+      for (int n = 0; n < N; ++n)
+        tmp += I[i * N + n] * xj[n];
+      scratch[j * M + i] = tmp;
+    }
+  }
+
+  for (int j = 0; j < M; ++j)
+  {
+    double * out = Ix + j * M;
+    for (int i = 0; i < M; ++i)
+      out[i] = 0.0;
+
+    for (int n = 0; n < N; ++n)
+    {
+      const double Ijn = I[j * N + n];
+      const double * in = scratch + n * M;
+      for (int i = 0; i < M; ++i)
+        out[i] += Ijn * in[i];
+    }
+  }
+}
+
+/**
+ * Interpolate volume data from N to M points in 1-D for an arbitrary number of points
+ * @param[in] I interpolation matrix
+ * @param[in] x element data to be interpolated
+ * @param[in] N number of points in 1-D to be interpolated
+ * @param[out] Ix interpolated data
+ * @param[in] M resulting number of interpolated points in 1-D
+ * @param[in] scratch scratch space of at least volumeScratchSize(N, M) entries
+ */
+void hexVolume(const double * I, const double * x, const int N, double * Ix, const int M, double * scratch);
+
+/**
+ * Interpolate face data from N to M points in 1-D for an arbitrary number of points
+ * @param[in] I interpolation matrix
+ * @param[in] x face data to be interpolated
+ * @param[in] N number of points in 1-D to be interpolated
+ * @param[out] Ix interpolated data
+ * @param[in] M resulting number of interpolated points in 1-D
+ * @param[in] scratch scratch space of at least faceScratchSize(N, M) entries
+ */
+void hexFace(const double * I, const double * x, const int N, double * Ix, const int M, double * scratch);
+
+/**
+ * Get the compile-time specialized volume kernel for interpolating from N to M points
+ * @param[in] N number of points in 1-D to be interpolated
+ * @param[in] M resulting number of interpolated points in 1-D
+ * @return specialized kernel, or nullptr if no specialization exists
+ */
+VolumeKernel volumeKernel(const int N, const int M);
+
+/**
+ * Get the compile-time specialized face kernel for interpolating from N to M points
+ * @param[in] N number of points in 1-D to be interpolated
+ * @param[in] M resulting number of interpolated points in 1-D
+ * @return specialized kernel, or nullptr if no specialization exists
+ */
+FaceKernel faceKernel(const int N, const int M);
+
+/**
+ * \brief Interpolation from one fixed set of points to another, with preallocated scratch space
+ *
+ * This object selects the specialized kernel (if any) once at construction and owns
+ * the scratch space needed by the kernels, so that repeated calls for every element
+ * in a mesh are allocation-free. Each thread performing interpolations should own
+ * its own instance.
+ */
+class Interpolator
+{
+public:
+  /**
+   * @param[in] I interpolation matrix, of size M x N (not owned by this object)
+   * @param[in] N number of points in 1-D to be interpolated
+   * @param[in] M resulting number of interpolated points in 1-D
+   */
+  Interpolator(const double * I, const int N, const int M);
+
+  ~Interpolator();
+
+  Interpolator(const Interpolator &) = delete;
+  Interpolator & operator=(const Interpolator &) = delete;
+
+  /**
+   * Interpolate volume data
+   * @param[in] x element data to be interpolated
+   * @param[out] Ix interpolated data
+   */
+  void volume(const double * x, double * Ix) const;
+
+  /**
+   * Interpolate face data
+   * @param[in] x face data to be interpolated
+   * @param[out] Ix interpolated data
+   */
+  void face(const double * x, double * Ix) const;
+
+  /**
+   * Whether a compile-time specialized kernel is used for the volume interpolation
+   * @return whether the volume kernel is specialized
+   */
+  bool specialized() const { return _volume_kernel; }
+
+  /**
+   * Scratch space large enough to hold the input to one volume interpolation, for callers
+   * that need to gather element data before interpolating
+   * @return input scratch space
+   */
+  double * input() const { return _input; }
+
+  /**
+   * Scratch space large enough to hold the output of one volume interpolation
+   * @return output scratch space
+   */
+  double * output() const { return _output; }
+
+protected:
+  /// Interpolation matrix
+  const double * _I;
+
+  /// Number of points in 1-D to be interpolated
+  const int _N;
+
+  /// Resulting number of interpolated points in 1-D
+  const int _M;
+
+  /// Specialized volume kernel, or nullptr if the generic kernel should be used
+  VolumeKernel _volume_kernel;
+
+  /// Specialized face kernel, or nullptr if the generic kernel should be used
+  FaceKernel _face_kernel;
+
+  /// Scratch space for the intermediate stages of the tensor-product interpolation
+  double * _scratch;
+
+  /// Scratch space holding the input to an interpolation
+  double * _input;
+
+  /// Scratch space holding the output of an interpolation
+  double * _output;
+};
+
+} // end namespace interpolation
@@ -574,14 +574,37 @@ public:
   const Point channelCentroid(const std::vector<Point> & corners) const;
 
   /**
-   * Get the channel index given a point
+   * Get the channel index given a point; the channel is found in constant time from the
+   * position of the point relative to the pin lattice and the duct walls
    * @param[in] point point
    * @return channel index
    */
   const unsigned int channelIndex(const Point & point) const;
 
+  /**
+   * Get the channel index given a point and its channel type using only the constant-time
+   * lookup, without falling back to the search over all the channels
+   * @param[in] point point
+   * @param[in] channel channel type of the point
+   * @return channel index, or INVALID_CHANNEL if the lookup misses
+   */
+  const unsigned int lookupChannelIndex(const Point & point,
+                                        const channel_type::ChannelTypeEnum & channel) const;
+
+  /**
+   * Get the channel index given a point by checking whether the point is inside each
+   * channel of the given type
+   * @param[in] point point
+   * @param[in] channel channel type of the point
+   * @return channel index
+   */
+  const unsigned int searchChannelIndex(const Point & point, const channel_type::ChannelTypeEnum & channel) const;
+
   std::pair<int, int> sortedGap(const int & id0, const int & id1) const;
 
+  /// Marker for points not found by the channel lookup
+  static const unsigned int INVALID_CHANNEL;
+
 protected:
   /**
    * Get the global gap index from the local gap index
@@ -767,6 +790,12 @@ protected:
   /// Number of sides in a hexagon
   static const unsigned int NUM_SIDES;
 
+  /**
+   * Interior channel index for each triangle of the pin lattice, indexed by
+   * interiorChannelLookupIndex
+   */
+  std::vector<unsigned int> _interior_channel_lookup;
+
   /// (unitless) x-translations to apply to move from a center point to a side of a hexagon
   std::vector<Real> _translation_x;
 
@@ -808,4 +837,14 @@ private:
 
   /// Get the pin indices that form the corners of each channel type
   void computeChannelPinIndices();
+
+  /// Map each triangle of the pin lattice to the interior channel it forms
+  void computeInteriorChannelLookup();
+
+  /**
+   * Get the index of the triangle of the pin lattice containing a point
+   * @param[in] point point
+   * @return index into _interior_channel_lookup, or INVALID_CHANNEL if outside the lattice
+   */
+  unsigned int interiorChannelLookupIndex(const Point & point) const;
 };
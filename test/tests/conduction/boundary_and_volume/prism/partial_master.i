@@ -0,0 +1,137 @@
+# This input sends a flux and heat source to nekRS that change between steps only
+# on the x > 0 half of the domain, so that nekRS skips re-writing the elements on the
+# other half. The nekRS temperature must match a run that re-writes every element.
+
+[Mesh]
+  type = FileMesh
+  file = prism.exo
+[]
+
+[Variables]
+  [dummy]
+  []
+[]
+
+[AuxVariables]
+  [flux]
+  []
+  [source]
+    block = '1'
+  []
+  [nek_temp]
+    initial_condition = 500.0
+  []
+[]
+
+[Functions]
+  [flux]
+    type = ParsedFunction
+    value = '1000+if(x>0,500*t,0)'
+  []
+  [source]
+    type = ParsedFunction
+    value = '500+if(x>0,1000*t,0)'
+  []
+[]
+
+[Kernels]
+  [dummy]
+    type = Diffusion
+    variable = dummy
+  []
+[]
+
+[AuxKernels]
+  [flux]
+    type = FunctionAux
+    variable = flux
+    function = flux
+  []
+  [source]
+    type = FunctionAux
+    variable = source
+    function = source
+    block = '1'
+  []
+[]
+
+[BCs]
+  [left]
+    type = DirichletBC
+    variable = dummy
+    boundary = 'vol2_top'
+    value = 1.0
+  []
+[]
+
+[Postprocessors]
+  [flux_integral]
+    type = SideIntegralVariablePostprocessor
+    variable = flux
+    boundary = '2'
+  []
+  [source_integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = source
+    block = '1'
+  []
+[]
+
+[MultiApps]
+  [nek]
+    type = TransientMultiApp
+    app_type = CardinalApp
+    input_files = 'nek.i'
+    execute_on = timestep_end
+  []
+[]
+
+[Transfers]
+  [flux]
+    type = MultiAppNearestNodeTransfer
+    source_variable = flux
+    direction = to_multiapp
+    multi_app = nek
+    variable = avg_flux
+    source_boundary = '2'
+  []
+  [flux_integral]
+    type = MultiAppPostprocessorTransfer
+    to_postprocessor = flux_integral
+    direction = to_multiapp
+    from_postprocessor = flux_integral
+    multi_app = nek
+  []
+  [source]
+    type = MultiAppNearestNodeTransfer
+    source_variable = source
+    direction = to_multiapp
+    multi_app = nek
+    variable = heat_source
+  []
+  [source_integral]
+    type = MultiAppPostprocessorTransfer
+    to_postprocessor = source_integral
+    direction = to_multiapp
+    from_postprocessor = source_integral
+    multi_app = nek
+  []
+  [temperature]
+    type = MultiAppNearestNodeTransfer
+    source_variable = temp
+    direction = from_multiapp
+    multi_app = nek
+    variable = nek_temp
+  []
+[]
+
+[Executioner]
+  type = Transient
+  dt = 0.05
+  num_steps = 4
+[]
+
+[Outputs]
+  exodus = true
+  print_linear_residuals = false
+[]
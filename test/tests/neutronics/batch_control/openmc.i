@@ -0,0 +1,74 @@
+[Mesh]
+  [pebble]
+    type = FileMeshGenerator
+    file = ../meshes/sphere_in_m.e
+  []
+  [repeat]
+    type = CombinerGenerator
+    inputs = pebble
+    positions = '0 0 0.02
+                 0 0 0.06
+                 0 0 0.10'
+  []
+  [set_block_ids]
+    type = SubdomainIDGenerator
+    input = repeat
+    subdomain_id = 0
+  []
+[]
+
+# This AuxVariable and AuxKernel is only here to get the postprocessors
+# to evaluate correctly. This can be deleted after MOOSE issue #17534 is fixed.
+[AuxVariables]
+  [cell_temperature]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+[]
+
+[AuxKernels]
+  [cell_temperature]
+    type = CellTemperatureAux
+    variable = cell_temperature
+  []
+  [temp]
+    type = FunctionAux
+    variable = temp
+    function = axial
+    execute_on = initial
+  []
+[]
+
+[Functions]
+  [axial]
+    type = ParsedFunction
+    value = '500 + z / 0.10 * 100'
+  []
+[]
+
+[Problem]
+  type = OpenMCCellAverageProblem
+  power = 1500.0
+  solid_blocks = '0'
+  tally_blocks = '0'
+  tally_type = cell
+  solid_cell_level = 1
+  scaling = 100.0
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+[]
+
+[Postprocessors]
+  [heat_source]
+    type = ElementIntegralVariablePostprocessor
+    variable = heat_source
+  []
+[]
+
+[Outputs]
+  csv = true
+  hide = 'cell_temperature'
+[]
@@ -0,0 +1,86 @@
+[Mesh]
+  [sphere]
+    type = FileMeshGenerator
+    file = ../meshes/sphere.e
+  []
+  [solid_ids]
+    type = SubdomainIDGenerator
+    input = sphere
+    subdomain_id = '100'
+  []
+
+  parallel_type = replicated
+[]
+
+# This AuxVariable and AuxKernel is only here to get the postprocessors
+# to evaluate correctly. This can be deleted after MOOSE issue #17534 is fixed.
+[AuxVariables]
+  [dummy]
+  []
+[]
+
+[AuxKernels]
+  [dummy]
+    type = ConstantAux
+    variable = dummy
+    value = 0.0
+  []
+[]
+
+[Problem]
+  type = OpenMCCellAverageProblem
+  solid_blocks = '100'
+  skip_first_incoming_transfer = true
+  verbose = true
+  solid_cell_level = 0
+  normalize_by_global_tally = true
+
+  tally_type = mesh
+  mesh_template = '../meshes/sphere.e'
+  power = 100.0
+  check_tally_sum = false
+  check_zero_tallies = false
+
+  output = 'heating_local fission'
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
+
+[Postprocessors]
+  [heat_source]
+    type = ElementIntegralVariablePostprocessor
+    variable = heat_source
+  []
+  [heating_local]
+    type = ElementIntegralVariablePostprocessor
+    variable = heating_local
+  []
+  [fission]
+    type = ElementIntegralVariablePostprocessor
+    variable = fission
+  []
+
+  # The local heating and the fission rate (at about 193 MeV recoverable energy per fission)
+  # should each be within 10% of the kappa-fission heat source
+  [heating_local_consistent]
+    type = ParsedPostprocessor
+    function = 'if(abs(heating_local / heat_source - 1.0) < 0.1, 1, 0)'
+    pp_names = 'heating_local heat_source'
+  []
+  [fission_consistent]
+    type = ParsedPostprocessor
+    function = 'if(abs(fission * 193.0e6 * 1.602176634e-19 / heat_source - 1.0) < 0.1, 1, 0)'
+    pp_names = 'fission heat_source'
+  []
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    execute_on = 'timestep_end'
+  []
+  hide = 'heat_source heating_local fission'
+[]
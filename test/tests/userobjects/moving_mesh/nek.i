@@ -0,0 +1,74 @@
+[Mesh]
+  type = NekRSMesh
+  volume = true
+  parallel_type = replicated
+[]
+
+[Problem]
+  type = NekRSStandaloneProblem
+  casename = 'moving'
+[]
+
+[AuxVariables]
+  [binned_volume]
+    family = MONOMIAL
+    order = CONSTANT
+  []
+[]
+
+[AuxKernels]
+  [binned_volume]
+    type = SpatialUserObjectAux
+    variable = binned_volume
+    user_object = binned_volume
+  []
+[]
+
+[UserObjects]
+  [one_bin]
+    type = LayeredBin
+    direction = z
+    num_layers = 1
+  []
+  [binned_volume]
+    type = NekBinnedVolumeIntegral
+    bins = 'one_bin'
+    field = unity
+  []
+[]
+
+[Executioner]
+  type = Transient
+
+  [TimeStepper]
+    type = NekTimeStepper
+  []
+[]
+
+[Postprocessors]
+  [binned_volume]
+    type = PointValue
+    variable = binned_volume
+    point = '0.0 0.0 -0.9'
+  []
+  [volume]
+    type = NekVolumeIntegral
+    field = unity
+  []
+
+  # nekRS compresses the mesh on every time step, so the binned volume only matches the
+  # volume if the bins are recomputed as the mesh moves
+  [binned_volume_consistent]
+    type = ParsedPostprocessor
+    function = 'if(abs(binned_volume / volume - 1.0) < 1e-8, 1, 0)'
+    pp_names = 'binned_volume volume'
+  []
+[]
+
+[Outputs]
+  [csv]
+    type = CSV
+    execute_on = 'timestep_end'
+  []
+  hide = 'binned_volume volume'
+[]
@@ -0,0 +1,52 @@
+/********************************************************************/
+/*                  SOFTWARE COPYRIGHT NOTIFICATION                 */
+/*                             Cardinal                             */
+/*                                                                  */
+/*                  (c) 2021 UChicago Argonne, LLC                  */
+/*                        ALL RIGHTS RESERVED                       */
+/*                                                                  */
+/*                 Prepared by UChicago Argonne, LLC                */
+/*               Under Contract No. DE-AC02-06CH11357               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*             Prepared by Battelle Energy Alliance, LLC            */
+/*               Under Contract No. DE-AC07-05ID14517               */
+/*                With the U. S. Department of Energy               */
+/*                                                                  */
+/*                 See LICENSE for full restrictions                */
+/********************************************************************/
+
+#pragma once
+
+#include "GLLInterpolation.h"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+class GLLInterpolationTest : public ::testing::Test
+{
+public:
+  /**
+   * Fill a vector with reproducible pseudo-random values in [-1, 1]
+   * @param[in] n number of values
+   * @param[in] seed seed for the sequence
+   * @return values
+   */
+  std::vector<double> values(const int n, unsigned int seed) const
+  {
+    std::vector<double> v(n);
+    for (auto & x : v)
+    {
+      seed = seed * 1103515245 + 12345;
+      x = 2.0 * ((seed / 65536) % 32768) / 32767.0 - 1.0;
+    }
+
+    return v;
+  }
+
+  /// nekRS polynomial orders for which kernels are specialized
+  const std::vector<int> _nek_orders = {3, 4, 5, 6, 7, 8, 9};
+
+  /// mesh mirror orders for which kernels are specialized
+  const std::vector<int> _mirror_orders = {1, 2};
+};